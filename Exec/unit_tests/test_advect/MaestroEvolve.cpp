@@ -2,6 +2,7 @@
 #include <Maestro.H>
 
 using namespace amrex;
+using namespace problem_rp;
 
 // advance solution to final time
 void Maestro::Evolve() {
@@ -79,8 +80,35 @@ void Maestro::Evolve() {
     //  loop over all possible directions
     // -------------------------------------------------------------------------
 
-    for (auto i = 0; i < AMREX_SPACEDIM; i++) {
-        for (auto j = -1; j <= 1; j += 2) {
+    // with do_bds, every advection method is compared: ppm_type = 0, 1, 2
+    // and then bds_type = 1 (2-d only, since BDS is not supported in
+    // 3-d).  Otherwise only the method in the inputs is run.
+    if (do_bds && ng_s < 4) {
+        Abort("test_advect with do_bds = 1 needs ppm_type = 2 or bds_type = 1");
+    }
+
+    const int ppm_type_in = ppm_type;
+    const int bds_type_in = bds_type;
+    const int nmethods = do_bds ? (AMREX_SPACEDIM == 2 ? 4 : 3) : 1;
+    Vector<Real> method_norm(nmethods, 0.0);
+    Vector<Real> method_time(nmethods, 0.0);
+
+    for (int method = 0; method < nmethods; ++method) {
+        if (do_bds) {
+            ppm_type = amrex::min(method, 2);
+            bds_type = (method == 3) ? 1 : 0;
+
+            Print() << "\nAdvection method: "
+                    << (bds_type == 1 ? "bds_type = 1" : "ppm_type = ")
+                    << (bds_type == 1 ? "" : std::to_string(ppm_type))
+                    << std::endl;
+        }
+
+        // each direction i, first with velocity j = -1 then j = +1
+        for (int n = 0; n < 2 * AMREX_SPACEDIM; ++n) {
+            const int i = n / 2;
+            const int j = 2 * (n % 2) - 1;
+
             t_old = 0.0;
             t_new = 0.0;
             istep = 1;
@@ -175,9 +203,15 @@ void Maestro::Evolve() {
                  ++istep) {
                 t_old = t_new;
 
+                Gpu::synchronize();
+                Real strt_time = ParallelDescriptor::second();
+
                 DensityAdvance(1, sold, snew, sedge, sflux, scal_force,
                                etarhoflux, umac, w0mac, rho0_predicted_edge);
 
+                Gpu::synchronize();
+                method_time[method] += ParallelDescriptor::second() - strt_time;
+
                 // move new state into old state by swapping pointers
                 for (int lev = 0; lev <= finest_level; ++lev) {
                     std::swap(sold[lev], snew[lev]);
@@ -208,6 +242,110 @@ void Maestro::Evolve() {
                 Print() << "\tAbs norm = " << abs_norm[lev]
                         << "  Rel norm = " << rel_norm[lev] << std::endl;
             }
+
+            method_norm[method] +=
+                rel_norm[finest_level] / (2.0 * AMREX_SPACEDIM);
         }
     }
+
+    ppm_type = ppm_type_in;
+    bds_type = bds_type_in;
+
+    for (int method = 0; method < nmethods; ++method) {
+        ParallelDescriptor::ReduceRealMax(
+            method_time[method], ParallelDescriptor::IOProcessorNumber());
+    }
+
+    if (do_bds) {
+        Print() << "\nRelative error on the finest level, averaged over the "
+                   "directions, and time spent advancing the density"
+                << std::endl;
+        for (int method = 0; method < nmethods; ++method) {
+            Print() << (method == 3 ? "  bds_type = 1 : "
+                                    : "  ppm_type = " +
+                                          std::to_string(method) + " : ")
+                    << "rel norm = " << method_norm[method]
+                    << ", time = " << method_time[method] << " s" << std::endl;
+        }
+    }
+
+    // time the slope and PPM reconstructions of the density on their own,
+    // for each slope_order and ppm_type
+    if (n_recon_bench > 0) {
+        const int slope_order_in = slope_order;
+
+        Vector<MultiFab> Ip(finest_level + 1);
+        Vector<MultiFab> Im(finest_level + 1);
+        Long ncells = 0;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            Ip[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+            Im[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+            ncells += grids[lev].numPts();
+        }
+
+        Print() << "\nReconstruction benchmark, " << n_recon_bench
+                << " calls on " << ncells << " cells" << std::endl;
+
+        // schemes 0-2 are slope_order = 0, 2, 4 and 3-4 are ppm_type = 1, 2
+        for (int scheme = 0; scheme < 5; ++scheme) {
+            const bool use_ppm = scheme >= 3;
+            if (use_ppm) {
+                ppm_type = scheme - 2;
+            } else {
+                slope_order = 2 * scheme;
+            }
+
+            Real strt_time = 0.0;
+            // the first pass is a warm up
+            for (int n = -1; n < n_recon_bench; ++n) {
+                if (n == 0) {
+                    Gpu::synchronize();
+                    strt_time = ParallelDescriptor::second();
+                }
+
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    const Box& domainBox = geom[lev].Domain();
+                    const auto dx = geom[lev].CellSizeArray();
+
+                    for (MFIter mfi(sold[lev], TilingIfNotGPU()); mfi.isValid();
+                         ++mfi) {
+                        const Box& obx = mfi.growntilebox(1);
+                        const Array4<Real> scal_arr = sold[lev].array(mfi);
+                        const Array4<Real> Ip_arr = Ip[lev].array(mfi);
+                        const Array4<Real> Im_arr = Im[lev].array(mfi);
+
+                        if (use_ppm) {
+                            PPM(obx, scal_arr, umac[lev][0].const_array(mfi),
+                                umac[lev][1].const_array(mfi),
+#if (AMREX_SPACEDIM == 3)
+                                umac[lev][2].const_array(mfi),
+#endif
+                                Ip_arr, Im_arr, domainBox, bcs_s, dx, true, Rho,
+                                Rho);
+                        } else {
+                            Array4<Real> const rho(scal_arr, Rho, 1);
+                            Slopex(obx, rho, Ip_arr, domainBox, bcs_s, 1, Rho);
+                            Slopey(obx, rho, Im_arr, domainBox, bcs_s, 1, Rho);
+#if (AMREX_SPACEDIM == 3)
+                            Slopez(obx, rho, Array4<Real>(Ip_arr, 1, 1),
+                                   domainBox, bcs_s, 1, Rho);
+#endif
+                        }
+                    }
+                }
+            }
+            Gpu::synchronize();
+            Real bench_time = ParallelDescriptor::second() - strt_time;
+            ParallelDescriptor::ReduceRealMax(
+                bench_time, ParallelDescriptor::IOProcessorNumber());
+
+            Print() << (use_ppm ? "  ppm_type    = " : "  slope_order = ")
+                    << (use_ppm ? ppm_type : slope_order) << " : "
+                    << Real(ncells) * n_recon_bench / bench_time << " cells/s"
+                    << std::endl;
+        }
+
+        slope_order = slope_order_in;
+        ppm_type = ppm_type_in;
+    }
 }
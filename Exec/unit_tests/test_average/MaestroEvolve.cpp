@@ -2,6 +2,7 @@
 #include <Maestro.H>
 
 using namespace amrex;
+using namespace problem_rp;
 
 // advance solution to final time
 void Maestro::Evolve() {
@@ -55,4 +56,110 @@ void Maestro::Evolve() {
                     << ",  Rel norm = " << rel_norm << std::endl;
         }
     }
+
+    // time the atomic-add binning against the privatized binning
+    if (n_average_bench > 0) {
+        const int nlanes = average_bin_lanes;
+        BaseState<Real> phi_atomic(base_geom.max_radial_level + 1, nr_fine);
+
+        Vector<Real> bench_time(2, 0.0);
+        for (int n = 0; n < 2; ++n) {
+            average_bin_lanes = (n == 0) ? 0 : amrex::max(nlanes, 1);
+            BaseState<Real>& phi_bench = (n == 0) ? phi_atomic : phi_avg;
+
+            // warm up
+            Average(phi, phi_bench, 0);
+
+            const Real strt_time = ParallelDescriptor::second();
+            for (int i = 0; i < n_average_bench; ++i) {
+                Average(phi, phi_bench, 0);
+            }
+            bench_time[n] = ParallelDescriptor::second() - strt_time;
+        }
+        average_bin_lanes = nlanes;
+
+        ParallelDescriptor::ReduceRealMax(
+            bench_time.dataPtr(), 2, ParallelDescriptor::IOProcessorNumber());
+
+        auto phi_atomic_arr = phi_atomic.array();
+        Real max_diff = 0.0;
+        for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+            for (int r = 0; r < nr_fine; ++r) {
+                max_diff = amrex::max(max_diff,
+                                      amrex::Math::abs(phi_atomic_arr(lev, r) -
+                                                       phi_avg_arr(lev, r)));
+            }
+        }
+
+        Print() << "\nAverage benchmark, " << n_average_bench << " calls"
+                << std::endl;
+        Print() << "  atomic adds        : " << bench_time[0] << " seconds"
+                << std::endl;
+        Print() << "  private histograms : " << bench_time[1] << " seconds"
+                << std::endl;
+        Print() << "  max difference     : " << max_diff << std::endl;
+    }
+
+    // time Put1dArrayOnCart for each interpolation type, computing the
+    // spherical stencils on the fly and reading them from the cached tables
+    if (n_put1d_bench > 0) {
+        const int s0_interp_type_in = s0_interp_type;
+        const int w0_interp_type_in = w0_interp_type;
+        const bool cache_in = cache_sphr_stencils;
+
+        Long ncells = 0;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            ncells += phi[lev].boxArray().numPts();
+        }
+
+        BaseState<Real> phi_edge(base_geom.max_radial_level + 1, nr_fine + 1);
+        phi_edge.setVal(1.0);
+
+        Print() << "\nPut1dArrayOnCart benchmark, " << n_put1d_bench
+                << " calls on " << ncells << " cells" << std::endl;
+
+        for (int type = 1; type <= 3; ++type) {
+            s0_interp_type = type;
+            w0_interp_type = type;
+
+            for (int cache = 0; cache <= 1; ++cache) {
+                // the stencils depend on the interpolation type
+                cache_sphr_stencils = cache == 1;
+#if (AMREX_SPACEDIM == 3)
+                MakeSphrStencils();
+#endif
+
+                for (int edge = 0; edge <= 1; ++edge) {
+                    const BaseState<Real>& s0 =
+                        (edge == 1) ? phi_edge : phi_exact;
+
+                    // warm up
+                    Put1dArrayOnCart(s0, phi, edge == 1, false);
+
+                    const Real strt_time = ParallelDescriptor::second();
+                    for (int i = 0; i < n_put1d_bench; ++i) {
+                        Put1dArrayOnCart(s0, phi, edge == 1, false);
+                    }
+                    Real bench_time = ParallelDescriptor::second() - strt_time;
+                    ParallelDescriptor::ReduceRealMax(
+                        bench_time, ParallelDescriptor::IOProcessorNumber());
+
+                    Print() << "  interp type " << type
+                            << ((edge == 1) ? ", edge-centered"
+                                            : ", cell-centered")
+                            << ((cache == 1) ? ", cached     : "
+                                             : ", on the fly : ")
+                            << Real(ncells) * n_put1d_bench / bench_time
+                            << " cells/s" << std::endl;
+                }
+            }
+        }
+
+        s0_interp_type = s0_interp_type_in;
+        w0_interp_type = w0_interp_type_in;
+        cache_sphr_stencils = cache_in;
+#if (AMREX_SPACEDIM == 3)
+        MakeSphrStencils();
+#endif
+    }
 }
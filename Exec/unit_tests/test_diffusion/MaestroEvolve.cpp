@@ -94,6 +94,9 @@ void Maestro::Evolve() {
     WritePlotFile(0, t_new, dt, dummy, dummy, dummy, dummy, sold, analytic,
                   error);
 
+    // wallclock time spent in ThermalConduct
+    Real conduct_time = 0.0;
+
     for (istep = start_step; istep <= max_step && t_old < stop_time; ++istep) {
         Print() << "\nTimestep " << istep << " starts with TIME = " << t_old
                 << " DT = " << dt << std::endl
@@ -119,8 +122,10 @@ void Maestro::Evolve() {
 
             // diffuse the enthalpy
             Print() << "... conducting" << std::endl;
+            Real conduct_start = ParallelDescriptor::second();
             ThermalConduct(sold, snew, hcoeff1, Xkcoeff1, pcoeff1, hcoeff2,
                            Xkcoeff2, pcoeff2);
+            conduct_time += ParallelDescriptor::second() - conduct_start;
 
             // now update temperature
             TfromRhoH(snew, p0_new);
@@ -202,4 +207,8 @@ void Maestro::Evolve() {
     WritePlotFile(istep, t_new, dt, dummy, dummy, dummy, dummy, sold, analytic,
                   error);
 
+    ParallelDescriptor::ReduceRealMax(conduct_time,
+                                      ParallelDescriptor::IOProcessorNumber());
+    Print() << "\nTime in ThermalConduct with " << NumSpec
+            << " species = " << conduct_time << std::endl;
 }
@@ -213,4 +213,105 @@ void Maestro::Evolve() {
         Print() << "Error in T   from p  , s = " << error[lev].norm2(4)
                 << std::endl;
     }
+
+    // time the edge EOS calls of HfromRhoTedge.  The edge states on each
+    // face are those of the cell on its high side, so the enthalpy it
+    // returns should match the cell's.
+    if (n_edge_bench > 0) {
+        const auto enthalpy_pred_type_in = enthalpy_pred_type;
+        const auto species_pred_type_in = species_pred_type;
+        enthalpy_pred_type = predict_T_then_h;
+        species_pred_type = predict_rho_and_X;
+
+        FillPatch(t_old, sold, sold, sold, 0, 0, Nscal, 0, bcs_s);
+
+        // the base state is not used by these prediction types
+        BaseState<Real> base_edge(base_geom.max_radial_level + 1,
+                                  base_geom.nr_fine + 1);
+        base_edge.setVal(0.0);
+
+        Vector<std::array<MultiFab, AMREX_SPACEDIM> > sedge(finest_level +
+                                                            1);
+        Long nfaces = 0;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                sedge[lev][d].define(
+                    convert(grids[lev], IntVect::TheDimensionVector(d)),
+                    dmap[lev], Nscal, 0);
+                nfaces += sedge[lev][d].boxArray().numPts();
+            }
+        }
+
+        Real strt_time = 0.0;
+        // the first pass is a warm up
+        for (int n = -1; n < n_edge_bench; ++n) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    for (MFIter mfi(sedge[lev][d], TilingIfNotGPU());
+                         mfi.isValid(); ++mfi) {
+                        const Array4<const Real> scal =
+                            sold[lev].const_array(mfi);
+                        const Array4<Real> edge = sedge[lev][d].array(mfi);
+
+                        ParallelFor(mfi.tilebox(), Nscal,
+                                    [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                         int comp) {
+                                        edge(i, j, k, comp) =
+                                            scal(i, j, k, comp);
+                                    });
+                    }
+                }
+            }
+
+            Gpu::synchronize();
+            if (n == 0) {
+                strt_time = ParallelDescriptor::second();
+            }
+
+            HfromRhoTedge(sedge, base_edge, base_edge, base_edge, base_edge);
+        }
+        Gpu::synchronize();
+        Real bench_time = ParallelDescriptor::second() - strt_time;
+        ParallelDescriptor::ReduceRealMax(
+            bench_time, ParallelDescriptor::IOProcessorNumber());
+
+        // compare the edge enthalpy to the cell's
+        ReduceOps<ReduceOpMax> reduce_op;
+        ReduceData<Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                for (MFIter mfi(sedge[lev][d]); mfi.isValid(); ++mfi) {
+                    const Array4<const Real> scal =
+                        sold[lev].const_array(mfi);
+                    const Array4<const Real> edge =
+                        sedge[lev][d].const_array(mfi);
+
+                    reduce_op.eval(
+                        mfi.validbox(), reduce_data,
+                        [=] AMREX_GPU_DEVICE(int i, int j,
+                                             int k) -> ReduceTuple {
+                            const Real h =
+                                scal(i, j, k, RhoH) / scal(i, j, k, Rho);
+                            return {amrex::Math::abs(edge(i, j, k, RhoH) -
+                                                     h) /
+                                    h};
+                        });
+                }
+            }
+        }
+        Real h_error = amrex::get<0>(reduce_data.value());
+        ParallelDescriptor::ReduceRealMax(h_error);
+
+        Print() << "\nEdge EOS benchmark, " << n_edge_bench << " calls on "
+                << nfaces << " faces: " << Real(nfaces) * n_edge_bench /
+                                               bench_time
+                << " faces/s" << std::endl;
+        Print() << "Error in h   from rho, T on edges = " << h_error
+                << std::endl;
+
+        enthalpy_pred_type = enthalpy_pred_type_in;
+        species_pred_type = species_pred_type_in;
+    }
 }
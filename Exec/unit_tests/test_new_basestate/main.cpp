@@ -101,6 +101,70 @@ int main(int argc, char* argv[]) {
         Print() << "subtract in place" << std::endl;
 
         base_state -= other_base_state;
+
+        Print() << "evaluate an expression in place" << std::endl;
+
+        summed_state.copy(0.5 * (base_state + other_base_state) - 1.0);
+
+        Print() << "summed_state = " << summed_state.array()(0, 0, 0)
+                << std::endl;
+    }
+
+    {
+        // time evaluating the typical time-centering expressions with
+        // explicit temporaries (one deep copy and one sweep per operator)
+        // against the fused expression templates
+        const int ntrials = 100;
+        const Real dt = 0.1;
+
+        for (const int nr : {10000, 100000}) {
+            BaseState<Real> p0_old(1, nr);
+            BaseState<Real> p0_new(1, nr);
+            BaseState<Real> p0_nph(1, nr);
+            BaseState<Real> psi(1, nr);
+
+            auto old_arr = p0_old.array();
+            auto new_arr = p0_new.array();
+            AMREX_PARALLEL_FOR_1D(nr, r, {
+                old_arr(0, r) = 1.0 + Real(r);
+                new_arr(0, r) = 2.0 + Real(r);
+            });
+            Gpu::synchronize();
+
+            Real strt_time = ParallelDescriptor::second();
+
+            for (auto n = 0; n < ntrials; ++n) {
+                BaseState<Real> sum(p0_old);
+                sum += p0_new;
+                sum *= 0.5;
+                p0_nph.copy(sum);
+
+                BaseState<Real> diff(p0_new);
+                diff -= p0_old;
+                diff /= dt;
+                psi.copy(diff);
+            }
+
+            const Real eager_time = ParallelDescriptor::second() - strt_time;
+
+            BaseState<Real> p0_nph_eager(p0_nph);
+            BaseState<Real> psi_eager(psi);
+
+            strt_time = ParallelDescriptor::second();
+
+            for (auto n = 0; n < ntrials; ++n) {
+                p0_nph.copy(0.5 * (p0_old + p0_new));
+                psi.copy((p0_new - p0_old) / dt);
+            }
+
+            const Real expr_time = ParallelDescriptor::second() - strt_time;
+
+            Print() << "nr = " << nr << ": temporaries "
+                    << eager_time / ntrials << " s, expression templates "
+                    << expr_time / ntrials << " s, results agree? "
+                    << (p0_nph == p0_nph_eager && psi == psi_eager)
+                    << std::endl;
+        }
     }
 
     // destroy timer for profiling
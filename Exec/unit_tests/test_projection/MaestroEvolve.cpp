@@ -823,7 +823,13 @@ void Maestro::Evolve() {
             std::swap(umid[lev], unew[lev]);
 
         // hgproject
+        Real proj_time = ParallelDescriptor::second();
         NodalProj(initial_projection_comp, rhcc_for_nodalproj);
+        proj_time = ParallelDescriptor::second() - proj_time;
+        ParallelDescriptor::ReduceRealMax(
+            proj_time, ParallelDescriptor::IOProcessorNumber());
+        Print() << "\nTime for the nodal projection = " << proj_time
+                << std::endl;
 
         // swap pointers to restore initial data to uold and new data to unew
         for (int lev = 0; lev <= finest_level; ++lev) {
@@ -882,7 +888,12 @@ void Maestro::Evolve() {
 
         // macproject
         auto is_predictor = 0;
+        Real proj_time = ParallelDescriptor::second();
         MacProj(umac_new, macpi, macrhs, beta0_old, is_predictor);
+        proj_time = ParallelDescriptor::second() - proj_time;
+        ParallelDescriptor::ReduceRealMax(
+            proj_time, ParallelDescriptor::IOProcessorNumber());
+        Print() << "\nTime for the MAC projection = " << proj_time << std::endl;
 
         // I think now can compare to umac_old and see if it's the same?
         {
@@ -16,6 +16,7 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     Real react_time = 0.0;
     Real misc_time = 0.0;
     Real base_time = 0.0;
+    solver_setup_time = 0.0;
 
     // HACK
     Real base_time_start = ParallelDescriptor::second();
@@ -123,66 +124,76 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
-        macrhs[lev].define(grids[lev], dmap[lev], 1, 0);
-        macphi[lev].define(grids[lev], dmap[lev], 1, 1);
-        S_cc_nph[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        thermal1[lev].define(grids[lev], dmap[lev], 1, 0);
-        thermal2[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        s1[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_omegadot[lev], grids[lev], dmap[lev], NumSpec, 0);
+        DefineScratch(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hnuc[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
         s1[lev].setVal(0.);
-        s2[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2star[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_p_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff1[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff2[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
+        DefineScratch(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(p0_cart[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, 1);
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi[lev].define(grids[lev], dmap[lev], 1, 0);
-        sponge[lev].define(grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(sponge[lev], grids[lev], dmap[lev], 1, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(etarhoflux[lev].define(convert(grids[lev], nodal_flag_x),
-                                            dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_y),
-                                              dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_z),
-                                              dmap[lev], 1, 1););
+#if (AMREX_SPACEDIM == 2)
+        DefineScratch(etarhoflux[lev], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+#else
+        DefineScratch(etarhoflux[lev], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
+#endif
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-                     , umac[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-                     , umac[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sedge[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sedge[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sflux[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sflux[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
+        AMREX_D_TERM(DefineScratch(umac[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   1, 1););
+        AMREX_D_TERM(DefineScratch(sedge[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
+        AMREX_D_TERM(DefineScratch(sflux[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
 
         // initialize umac
         for (int d = 0; d < AMREX_SPACEDIM; ++d) {
@@ -191,17 +202,18 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
             sflux[lev][d].setVal(0.);
         }
 
-        w0_force_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        DefineScratch(w0_force_cart[lev], grids[lev],
+                      dmap[lev], AMREX_SPACEDIM, 1);
     }
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev], 1,
-                             1);
-        w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev], 1,
-                             1);
-        w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev], 1,
-                             1);
+        DefineScratch(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
     }
 #endif
 
@@ -364,6 +376,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         delta_gamma1_term[lev].setVal(0.);
     }
 
+    // start from the last step's MAC solution if warm_start_projections
+    LoadProjectionGuess(macphi, macphi_guess);
+
     // compute RHS for MAC projection, beta0*(S_cc-Sbar) + beta0*delta_chi
     MakeRHCCforMacProj(macrhs, rho0_old, S_cc_nph, Sbar, beta0_old,
                        delta_gamma1_term, gamma1bar_old, p0_old, delta_p_term,
@@ -465,8 +480,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 #endif
             }
 
-            // correct the base state density by "averaging"
-            Average(s2, rho0_new, Rho);
+            // correct the base state density and compute rhoh0_old by
+            // "averaging"
+            Average({{s2, Rho, rho0_new}, {s1, RhoH, rhoh0_old}});
             ComputeCutoffCoords(rho0_new);
             base_geom.ComputeCutoffCoords(rho0_new.array());
         }
@@ -504,10 +520,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
             p0_nph.copy(0.5 * (p0_old + p0_new));
 
             // compute gamma1bar^{(1)} and store it in gamma1bar_temp1
-            MakeGamma1bar(s1, gamma1bar_temp1, p0_old);
-
             // compute gamma1bar^{(2),*} and store it in gamma1bar_temp2
-            MakeGamma1bar(s2, gamma1bar_temp2, p0_new);
+            MakeGamma1bar(s1, gamma1bar_temp1, p0_old, s2, gamma1bar_temp2,
+                          p0_new);
 
             // compute gamma1bar^{nph,*} and store it in gamma1bar_temp2
             gamma1bar_temp2.copy(0.5 * (gamma1bar_temp1 + gamma1bar_temp2));
@@ -517,8 +532,11 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         }
 
         // base state enthalpy update
-        // compute rhoh0_old by "averaging"
-        Average(s1, rhoh0_old, RhoH);
+        // compute rhoh0_old by "averaging" (done above along with rho0_new
+        // if use_etarho)
+        if (!use_etarho) {
+            Average(s1, rhoh0_old, RhoH);
+        }
 
         base_time_start = ParallelDescriptor::second();
 
@@ -784,6 +802,7 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_nph, is_predictor);
+    SaveProjectionGuess(macphi, macphi_guess);
 
     macproj_time += ParallelDescriptor::second() - macproj_time_start;
     ParallelDescriptor::ReduceRealMax(macproj_time,
@@ -1122,7 +1141,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
         Vector<MultiFab> rhcc_for_nodalproj_old(finest_level + 1);
         for (int lev = 0; lev <= finest_level; ++lev) {
-            rhcc_for_nodalproj_old[lev].define(grids[lev], dmap[lev], 1, 1);
+            DefineScratch(rhcc_for_nodalproj_old[lev], grids[lev],
+                          dmap[lev], 1, 1);
             MultiFab::Copy(rhcc_for_nodalproj_old[lev], rhcc_for_nodalproj[lev],
                            0, 0, 1, 1);
         }
@@ -1135,6 +1155,7 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
                                rhcc_for_nodalproj_old[lev], 0, 0, 1, 1);
             rhcc_for_nodalproj[lev].mult(1. / dt, 0, 1, 1);
         }
+        ReleaseScratch(rhcc_for_nodalproj_old);
 
     } else {
         proj_type = regular_timestep_comp;
@@ -1180,6 +1201,41 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         }
     }
 
+    // hand the level-wide temporaries back to the scratch pool so the
+    // next time step can reuse them
+    ReleaseScratch(rhohalf);
+    ReleaseScratch(macrhs);
+    ReleaseScratch(macphi);
+    ReleaseScratch(S_cc_nph);
+    ReleaseScratch(rho_omegadot);
+    ReleaseScratch(thermal1);
+    ReleaseScratch(thermal2);
+    ReleaseScratch(rho_Hnuc);
+    ReleaseScratch(rho_Hext);
+    ReleaseScratch(s1);
+    ReleaseScratch(s2);
+    ReleaseScratch(s2star);
+    ReleaseScratch(delta_gamma1_term);
+    ReleaseScratch(delta_gamma1);
+    ReleaseScratch(p0_cart);
+    ReleaseScratch(delta_p_term);
+    ReleaseScratch(Tcoeff);
+    ReleaseScratch(hcoeff1);
+    ReleaseScratch(Xkcoeff1);
+    ReleaseScratch(pcoeff1);
+    ReleaseScratch(hcoeff2);
+    ReleaseScratch(Xkcoeff2);
+    ReleaseScratch(pcoeff2);
+    ReleaseScratch(scal_force);
+    ReleaseScratch(delta_chi);
+    ReleaseScratch(sponge);
+    ReleaseScratch(etarhoflux);
+    ReleaseScratch(w0_force_cart);
+    ReleaseScratch(umac);
+    ReleaseScratch(sedge);
+    ReleaseScratch(sflux);
+    ReleaseScratch(w0mac);
+
     Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
             << " DT = " << dt << std::endl;
 
@@ -1189,6 +1245,10 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     ParallelDescriptor::Bcast(&misc_time, 1,
                               ParallelDescriptor::IOProcessorNumber());
 
+    Real setup_time = solver_setup_time;
+    ParallelDescriptor::ReduceRealMax(setup_time,
+                                      ParallelDescriptor::IOProcessorNumber());
+
     // print wallclock time
     if (maestro_verbose > 0) {
         Print() << "Timing summary:\n";
@@ -1201,5 +1261,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         Print() << "Reactions  :" << react_time << " seconds\n";
         Print() << "Misc       :" << misc_time << " seconds\n";
         Print() << "Base State :" << base_time << " seconds\n";
+        // this is included in the projection and thermal times above
+        Print() << "Solver setup :" << setup_time << " seconds\n";
+        PrintScratchPool();
+        PrintFabHighWater();
     }
 }
@@ -9,6 +9,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::AdvanceTimeStepAverage()", AdvanceTimeStepAverage);
 
+    solver_setup_time = 0.0;
+
     // cell-centered MultiFabs needed within the AdvanceTimeStep routine
     Vector<MultiFab> rhohalf(finest_level + 1);
     Vector<MultiFab> macrhs(finest_level + 1);
@@ -100,66 +102,75 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
-        macrhs[lev].define(grids[lev], dmap[lev], 1, 0);
-        macphi[lev].define(grids[lev], dmap[lev], 1, 1);
-        S_cc_nph[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        thermal1[lev].define(grids[lev], dmap[lev], 1, 0);
-        thermal2[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        s1[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2star[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_p_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff1[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff2[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
+        DefineScratch(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_omegadot[lev], grids[lev], dmap[lev], NumSpec, 0);
+        DefineScratch(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hnuc[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(p0_cart[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, 1);
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi[lev].define(grids[lev], dmap[lev], 1, 0);
-        sponge[lev].define(grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(sponge[lev], grids[lev], dmap[lev], 1, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(
-            etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-            , etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-            , etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
+#if (AMREX_SPACEDIM == 2)
+        DefineScratch(etarhoflux_dummy[lev], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+#else
+        DefineScratch(etarhoflux_dummy[lev], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
+#endif
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-                     , umac[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-                     , umac[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sedge[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sedge[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sflux[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sflux[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
+        AMREX_D_TERM(DefineScratch(umac[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   1, 1););
+        AMREX_D_TERM(DefineScratch(sedge[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
+        AMREX_D_TERM(DefineScratch(sflux[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
 
         // initialize umac
         for (int d = 0; d < AMREX_SPACEDIM; ++d) {
@@ -169,24 +180,24 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev], 1,
-                             1);
-        w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev], 1,
-                             1);
-        w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev], 1,
-                             1);
-        w0mac_dummy[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
-                                   1, 1);
-        w0mac_dummy[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
-                                   1, 1);
-        w0mac_dummy[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
-                                   1, 1);
+        DefineScratch(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac_dummy[lev][0], convert(grids[lev], nodal_flag_x),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac_dummy[lev][1], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac_dummy[lev][2], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
     }
 #endif
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0_force_cart_dummy[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM,
-                                        1);
+        DefineScratch(w0_force_cart_dummy[lev], grids[lev], dmap[lev],
+                      AMREX_SPACEDIM, 1);
         w0_force_cart_dummy[lev].setVal(0.);
     }
 
@@ -321,6 +332,9 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
         delta_gamma1_term[lev].setVal(0.);
     }
 
+    // start from the last step's MAC solution if warm_start_projections
+    LoadProjectionGuess(macphi, macphi_guess);
+
     // compute w0 just before the projection
     if (evolve_base_state) {
         // compute w0, w0_force
@@ -420,8 +434,13 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
                    w0mac_dummy, rho0_pred_edge_dummy);
 
     // correct the base state density by "averaging"
+    // also compute rhoh0_old here, since s1 is not changed before the
+    // enthalpy update
     if (evolve_base_state) {
-        Average(s2, rho0_new, Rho);
+        Average({{s2, Rho, rho0_new}, {s1, RhoH, rhoh0_old}});
+        // (rho h) in s2 is not advanced until EnthalpyAdvance and is still
+        // zero here, so the predictor's rhoh0_new (its average) is zero
+        rhoh0_new.setVal(0.);
         ComputeCutoffCoords(rho0_new);
     }
 
@@ -449,11 +468,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     }
 
     // base state enthalpy update
-    if (evolve_base_state) {
-        // compute rhoh0_old by "averaging"
-        Average(s1, rhoh0_old, RhoH);
-        Average(s2, rhoh0_new, RhoH);  // -> rhoh0_new = rhoh0_old (bad?)
-    } else {
+    // (rhoh0_old and rhoh0_new were set above)
+    if (!evolve_base_state) {
         rhoh0_new.copy(rhoh0_old);
     }
 
@@ -662,6 +678,7 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_nph, is_predictor);
+    SaveProjectionGuess(macphi, macphi_guess);
 
     // wallclock time
     end_total_macproj += ParallelDescriptor::second() - start_total_macproj;
@@ -704,9 +721,9 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     DensityAdvance(2, s1, s2, sedge, sflux, scal_force, etarhoflux_dummy, umac,
                    w0mac_dummy, rho0_pred_edge_dummy);
 
-    // correct the base state density by "averaging"
+    // correct the base state density and enthalpy by "averaging"
     if (evolve_base_state) {
-        Average(s2, rho0_new, Rho);
+        Average({{s2, Rho, rho0_new}, {s2, RhoH, rhoh0_new}});
         ComputeCutoffCoords(rho0_new);
     }
 
@@ -735,11 +752,6 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
         psi.copy((p0_new - p0_old) / dt);
     }
 
-    // base state enthalpy averaging
-    if (evolve_base_state) {
-        Average(s2, rhoh0_new, RhoH);
-    }
-
     // base state enthalpy update
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
@@ -904,7 +916,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
         Vector<MultiFab> rhcc_for_nodalproj_old(finest_level + 1);
         for (int lev = 0; lev <= finest_level; ++lev) {
-            rhcc_for_nodalproj_old[lev].define(grids[lev], dmap[lev], 1, 1);
+            DefineScratch(rhcc_for_nodalproj_old[lev], grids[lev],
+                          dmap[lev], 1, 1);
             MultiFab::Copy(rhcc_for_nodalproj_old[lev], rhcc_for_nodalproj[lev],
                            0, 0, 1, 1);
         }
@@ -917,6 +930,7 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
                                rhcc_for_nodalproj_old[lev], 0, 0, 1, 1);
             rhcc_for_nodalproj[lev].mult(1. / dt, 0, 1, 1);
         }
+        ReleaseScratch(rhcc_for_nodalproj_old);
     } else {
         proj_type = regular_timestep_comp;
 
@@ -971,13 +985,56 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
         }
     }
 
+    // hand the level-wide temporaries back to the scratch pool so the
+    // next time step can reuse them
+    ReleaseScratch(rhohalf);
+    ReleaseScratch(macrhs);
+    ReleaseScratch(macphi);
+    ReleaseScratch(S_cc_nph);
+    ReleaseScratch(rho_omegadot);
+    ReleaseScratch(thermal1);
+    ReleaseScratch(thermal2);
+    ReleaseScratch(rho_Hnuc);
+    ReleaseScratch(rho_Hext);
+    ReleaseScratch(s1);
+    ReleaseScratch(s2);
+    ReleaseScratch(s2star);
+    ReleaseScratch(delta_gamma1_term);
+    ReleaseScratch(delta_gamma1);
+    ReleaseScratch(p0_cart);
+    ReleaseScratch(delta_p_term);
+    ReleaseScratch(Tcoeff);
+    ReleaseScratch(hcoeff1);
+    ReleaseScratch(Xkcoeff1);
+    ReleaseScratch(pcoeff1);
+    ReleaseScratch(hcoeff2);
+    ReleaseScratch(Xkcoeff2);
+    ReleaseScratch(pcoeff2);
+    ReleaseScratch(scal_force);
+    ReleaseScratch(delta_chi);
+    ReleaseScratch(sponge);
+    ReleaseScratch(etarhoflux_dummy);
+    ReleaseScratch(w0_force_cart_dummy);
+    ReleaseScratch(umac);
+    ReleaseScratch(sedge);
+    ReleaseScratch(sflux);
+    ReleaseScratch(w0mac);
+    ReleaseScratch(w0mac_dummy);
+
     Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
             << " DT = " << dt << std::endl;
 
+    Real setup_time = solver_setup_time;
+    ParallelDescriptor::ReduceRealMax(setup_time,
+                                      ParallelDescriptor::IOProcessorNumber());
+
     // print wallclock time
     if (maestro_verbose > 0) {
         Print() << "Time to solve mac proj   : " << end_total_macproj << '\n';
         Print() << "Time to solve nodal proj : " << end_total_nodalproj << '\n';
         Print() << "Time to solve reactions  : " << end_total_react << '\n';
+        Print() << "Time to build solvers    : " << setup_time << '\n';
+        PrintScratchPool();
+        PrintFabHighWater();
     }
 }
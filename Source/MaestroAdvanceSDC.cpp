@@ -0,0 +1,1296 @@
+
+#include <Maestro.H>
+
+using namespace amrex;
+
+#ifdef SDC
+
+// advance a single time step, coupling the reactions to the advection with
+// spectral deferred corrections.  Instead of reacting over dt/2 on either
+// side of the advection, the burner integrates the reactions over the full
+// dt together with the advective source (s^adv - s^n) / dt, and each
+// correction iteration predicts the edge states again with the reactions
+// of the last iteration as a force.
+//
+// This is experimental: it has not yet been compared with the Strang-split
+// AdvanceTimeStep, and only the regular base state is supported.
+void Maestro::AdvanceTimeStepSDC(bool is_initIter) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::AdvanceTimeStepSDC()", AdvanceTimeStepSDC);
+
+    if (use_exact_base_state || average_base_state) {
+        Abort(
+            "AdvanceTimeStepSDC: use_exact_base_state and average_base_state "
+            "are not supported with SDC");
+    }
+
+    // timers
+    Real advect_time = 0.0;
+    Real macproj_time = 0.0;
+    Real ndproj_time = 0.0;
+    Real thermal_time = 0.0;
+    Real react_time = 0.0;
+    Real misc_time = 0.0;
+    Real base_time = 0.0;
+    solver_setup_time = 0.0;
+
+    Real misc_time_start = ParallelDescriptor::second();
+
+    // cell-centered MultiFabs needed within the AdvanceTimeStepSDC routine
+    Vector<MultiFab> rhohalf(finest_level + 1);
+    Vector<MultiFab> macrhs(finest_level + 1);
+    Vector<MultiFab> macphi(finest_level + 1);
+    Vector<MultiFab> S_cc_nph(finest_level + 1);
+    Vector<MultiFab> rho_omegadot(finest_level + 1);
+    Vector<MultiFab> thermal1(finest_level + 1);
+    Vector<MultiFab> thermal2(finest_level + 1);
+    Vector<MultiFab> rho_Hnuc(finest_level + 1);
+    Vector<MultiFab> rho_Hext(finest_level + 1);
+    Vector<MultiFab> s1(finest_level + 1);
+    Vector<MultiFab> s2(finest_level + 1);
+    Vector<MultiFab> s2star(finest_level + 1);
+    Vector<MultiFab> delta_gamma1_term(finest_level + 1);
+    Vector<MultiFab> delta_gamma1(finest_level + 1);
+    Vector<MultiFab> p0_cart(finest_level + 1);
+    Vector<MultiFab> delta_p_term(finest_level + 1);
+    Vector<MultiFab> Tcoeff(finest_level + 1);
+    Vector<MultiFab> hcoeff1(finest_level + 1);
+    Vector<MultiFab> Xkcoeff1(finest_level + 1);
+    Vector<MultiFab> pcoeff1(finest_level + 1);
+    Vector<MultiFab> hcoeff2(finest_level + 1);
+    Vector<MultiFab> Xkcoeff2(finest_level + 1);
+    Vector<MultiFab> pcoeff2(finest_level + 1);
+    Vector<MultiFab> scal_force(finest_level + 1);
+    Vector<MultiFab> delta_chi(finest_level + 1);
+    Vector<MultiFab> sponge(finest_level + 1);
+
+    // the advective source for the burner, the reaction force for the edge
+    // predictions, and the coefficients that turn the reactions into a
+    // temperature force
+    Vector<MultiFab> sdc_source(finest_level + 1);
+    Vector<MultiFab> intra_force(finest_level + 1);
+    Vector<MultiFab> cp(finest_level + 1);
+    Vector<MultiFab> xi(finest_level + 1);
+
+    // face-centered in the dm-direction (planar only)
+    Vector<MultiFab> etarhoflux(finest_level + 1);
+
+    // face-centered
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > umac(finest_level + 1);
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > sedge(finest_level + 1);
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > sflux(finest_level + 1);
+
+    ////////////////////////
+    // needed for spherical routines only
+
+    // cell-centered
+    Vector<MultiFab> w0_force_cart(finest_level + 1);
+
+    // face-centered
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
+
+    // end spherical-only MultiFabs
+    ////////////////////////
+
+    // vectors store the multilevel 1D states as one very long array
+    // these are cell-centered
+    BaseState<Real> grav_cell_nph(base_geom.max_radial_level + 1,
+                                  base_geom.nr_fine);
+    BaseState<Real> rho0_nph(base_geom.max_radial_level + 1, base_geom.nr_fine);
+    BaseState<Real> p0_nph(base_geom.max_radial_level + 1, base_geom.nr_fine);
+    BaseState<Real> p0_minus_peosbar(base_geom.max_radial_level + 1,
+                                     base_geom.nr_fine);
+    BaseState<Real> peosbar(base_geom.max_radial_level + 1, base_geom.nr_fine);
+    BaseState<Real> w0_force(base_geom.max_radial_level + 1, base_geom.nr_fine);
+    BaseState<Real> Sbar(base_geom.max_radial_level + 1, base_geom.nr_fine);
+    BaseState<Real> beta0_nph(base_geom.max_radial_level + 1,
+                              base_geom.nr_fine);
+    BaseState<Real> gamma1bar_temp1(base_geom.max_radial_level + 1,
+                                    base_geom.nr_fine);
+    BaseState<Real> gamma1bar_temp2(base_geom.max_radial_level + 1,
+                                    base_geom.nr_fine);
+    BaseState<Real> delta_gamma1_termbar(base_geom.max_radial_level + 1,
+                                         base_geom.nr_fine);
+
+    // vectors store the multilevel 1D states as one very long array
+    // these are edge-centered
+    BaseState<Real> w0_old(base_geom.max_radial_level + 1,
+                           base_geom.nr_fine + 1);
+    BaseState<Real> rho0_predicted_edge(base_geom.max_radial_level + 1,
+                                        base_geom.nr_fine + 1);
+
+    bool is_predictor;
+
+    Print() << "\nTimestep " << istep << " starts with TIME = " << t_old
+            << " DT = " << dt << std::endl
+            << std::endl;
+
+    if (maestro_verbose > 0) {
+        Print() << "Cell Count:" << std::endl;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            Print() << "Level " << lev << ", " << CountCells(lev) << " cells"
+                    << std::endl;
+        }
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // cell-centered MultiFabs
+        DefineScratch(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_omegadot[lev], grids[lev], dmap[lev], NumSpec, 0);
+        DefineScratch(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hnuc[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(p0_cart[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        DefineScratch(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        DefineScratch(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        if (ppm_trace_forces == 0) {
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
+        } else {
+            // we need more ghostcells if we are tracing the forces
+            DefineScratch(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        }
+        DefineScratch(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(sponge[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(sdc_source[lev], grids[lev], dmap[lev], Nscal, 0);
+        DefineScratch(intra_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        DefineScratch(cp[lev], grids[lev], dmap[lev], 1, 0);
+        DefineScratch(xi[lev], grids[lev], dmap[lev], NumSpec, 0);
+
+        // face-centered in the dm-direction (planar only)
+#if (AMREX_SPACEDIM == 2)
+        DefineScratch(etarhoflux[lev], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+#else
+        DefineScratch(etarhoflux[lev], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
+#endif
+
+        // face-centered arrays of MultiFabs
+        AMREX_D_TERM(DefineScratch(umac[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   1, 1);
+                   , DefineScratch(umac[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   1, 1););
+        AMREX_D_TERM(DefineScratch(sedge[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sedge[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
+        AMREX_D_TERM(DefineScratch(sflux[lev][0],
+                                   convert(grids[lev], nodal_flag_x), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][1],
+                                   convert(grids[lev], nodal_flag_y), dmap[lev],
+                                   Nscal, 0);
+                   , DefineScratch(sflux[lev][2],
+                                   convert(grids[lev], nodal_flag_z), dmap[lev],
+                                   Nscal, 0););
+
+        // initialize umac
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            umac[lev][d].setVal(0.);
+            sedge[lev][d].setVal(0.);
+            sflux[lev][d].setVal(0.);
+        }
+
+        DefineScratch(w0_force_cart[lev], grids[lev],
+                      dmap[lev], AMREX_SPACEDIM, 1);
+    }
+
+#if (AMREX_SPACEDIM == 3)
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        DefineScratch(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                      dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                      dmap[lev], 1, 1);
+    }
+#endif
+
+    if (!evolve_base_state) {
+        w0.setVal(0.0);
+    }
+
+    // make the sponge for all levels
+    if (do_sponge) {
+        SpongeInit(rho0_old);
+        MakeSponge(sponge);
+    }
+
+    // nothing is split off the advection, so the state it starts from is
+    // the old state
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(s1[lev], sold[lev], 0, 0, Nscal, ng_s);
+    }
+
+    misc_time += ParallelDescriptor::second() - misc_time_start;
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 1 -- define average expansion at time n+1/2
+    //////////////////////////////////////////////////////////////////////////////
+
+    Real advect_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 1 : make w0 >>>" << std::endl;
+    }
+
+    if (t_old == 0.) {
+        // this is either a pressure iteration or the first time step
+        // set S_cc_nph = (1/2) (S_cc_old + S_cc_new)
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::LinComb(S_cc_nph[lev], 0.5, S_cc_old[lev], 0, 0.5,
+                              S_cc_new[lev], 0, 0, 1, 0);
+        }
+    } else {
+        // set S_cc_nph = S_cc_old + (dt/2) * dSdt
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::LinComb(S_cc_nph[lev], 1.0, S_cc_old[lev], 0, 0.5 * dt,
+                              dSdt[lev], 0, 0, 1, 0);
+        }
+    }
+    // no ghost cells for S_cc_nph
+    AverageDown(S_cc_nph, 0, 1);
+
+    // compute p0_minus_peosbar = p0_old - peosbar_old (for making w0) and
+    // compute delta_p_term = peos_old - p0_old (for RHS of projections)
+    if (dpdt_factor > 0.0) {
+        // peos_old (delta_p_term) now holds the thermodynamic p computed from sold(rho,h,X)
+        PfromRhoH(sold, sold, delta_p_term);
+
+        // compute peosbar = Avg(peos_old)
+        Average(delta_p_term, peosbar, 0);
+
+        // compute p0_minus_peosbar = p0_old - peosbar
+        p0_minus_peosbar.copy(p0_old - peosbar);
+
+        // put p0_old on cart
+        Put1dArrayOnCart(p0_old, p0_cart, false, false, bcs_f, 0);
+
+        // compute delta_p_term = peos_old - p0_old
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0, 1, 0);
+        }
+    } else {
+        // these should have no effect if dpdt_factor <= 0
+        p0_minus_peosbar.setVal(0.0);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            delta_p_term[lev].setVal(0.);
+        }
+    }
+
+#if (AMREX_SPACEDIM == 3)
+    // initialize MultiFabs and Vectors to ZERO
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            w0mac[lev][d].setVal(0.);
+        }
+    }
+#endif
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        w0_force_cart[lev].setVal(0.);
+    }
+
+    if (evolve_base_state) {
+        // compute Sbar = average(S_cc_nph)
+        Average(S_cc_nph, Sbar, 0);
+
+        // save old-time value
+        w0_old.copy(w0);
+
+        Real base_time_start = ParallelDescriptor::second();
+
+        ComputeCutoffCoords(rho0_old);
+        base_geom.ComputeCutoffCoords(rho0_old.array());
+
+        // compute w0, w0_force
+        is_predictor = true;
+        Makew0(w0_old, w0_force, Sbar, rho0_old, rho0_old, p0_old, p0_old,
+               gamma1bar_old, gamma1bar_old, p0_minus_peosbar, dt, dtold,
+               is_predictor);
+
+        Put1dArrayOnCart(w0, w0_cart, true, true, bcs_u, 0, 1);
+
+        base_time += ParallelDescriptor::second() - base_time_start;
+
+        // put w0 on Cartesian edges
+#if (AMREX_SPACEDIM == 3)
+        if (spherical) {
+            MakeW0mac(w0mac);
+        }
+#endif
+        // put w0_force on Cartesian cells
+        Put1dArrayOnCart(w0_force, w0_force_cart, false, true, bcs_f, 0);
+
+    } else {
+        // these should have no effect if evolve_base_state = false
+        Sbar.setVal(0.);
+        w0_force.setVal(0.);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 2 -- construct the advective velocity
+    //////////////////////////////////////////////////////////////////////////////
+
+    advect_time += ParallelDescriptor::second() - advect_time_start;
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 2 : create MAC velocities >>>" << std::endl;
+    }
+
+    MakeMacVelocity(true, umac, w0mac, w0_force_cart, macphi, macrhs, S_cc_nph,
+                    Sbar, beta0_old, delta_gamma1_term, delta_p_term, delta_chi,
+                    advect_time, macproj_time);
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 3 -- predictor: advect the base state and full state through dt
+    // with no reaction force
+    //////////////////////////////////////////////////////////////////////////////
+
+    advect_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 3 : advect base >>>" << std::endl;
+    }
+
+    // advect the base state density
+    if (evolve_base_state) {
+        Real base_time_start = ParallelDescriptor::second();
+
+        AdvectBaseDens(rho0_predicted_edge);
+
+        base_time += ParallelDescriptor::second() - base_time_start;
+
+        ComputeCutoffCoords(rho0_new);
+        base_geom.ComputeCutoffCoords(rho0_new.array());
+    } else {
+        rho0_new.copy(rho0_old);
+    }
+
+    // thermal is the forcing for rhoh or temperature
+    if (use_thermal_diffusion) {
+        MakeThermalCoeffs(s1, Tcoeff, hcoeff1, Xkcoeff1, pcoeff1);
+
+        MakeExplicitThermal(thermal1, s1, Tcoeff, hcoeff1, Xkcoeff1, pcoeff1,
+                            p0_old, temp_diffusion_formulation);
+    } else {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            thermal1[lev].setVal(0.);
+        }
+    }
+
+    // copy temperature from s1 into s2 for seeding eos calls
+    // temperature will be overwritten later after enthalpy advance
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        s2[lev].setVal(0.);
+        MultiFab::Copy(s2[lev], s1[lev], Temp, Temp, 1, ng_s);
+    }
+
+    if (maestro_verbose >= 1) {
+        Print() << "            :  density_advance >>>" << std::endl;
+        Print() << "            :   tracer_advance >>>" << std::endl;
+    }
+
+    // set etarhoflux to zero
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        etarhoflux[lev].setVal(0.);
+    }
+
+    // need full UMAC velocities for DensityAdvance
+    Addw0(umac, w0mac, 1.);
+
+    // advect rhoX, rho, and tracers
+    DensityAdvance(1, s1, s2, sedge, sflux, scal_force, etarhoflux, umac, w0mac,
+                   rho0_predicted_edge);
+
+    // subtract w0mac from umac
+    Addw0(umac, w0mac, -1.);
+
+    UpdateBaseState(1, s1, s2, umac, w0mac, etarhoflux, rho0_predicted_edge,
+                    rho0_nph, p0_nph, grav_cell_nph, gamma1bar_temp1,
+                    gamma1bar_temp2, Sbar, base_time);
+
+    if (maestro_verbose >= 1) {
+        Print() << "            : enthalpy_advance >>>" << std::endl;
+    }
+
+    // need full UMAC velocities for EnthalpyAdvance
+    Addw0(umac, w0mac, 1.);
+
+    EnthalpyAdvance(1, s1, s2, sedge, sflux, scal_force, umac, w0mac, thermal1);
+
+    // subtract w0mac from umac
+    Addw0(umac, w0mac, -1.);
+
+    advect_time += ParallelDescriptor::second() - advect_time_start;
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 3a (Option I) -- Add thermal conduction (only enthalpy terms)
+    //////////////////////////////////////////////////////////////////////////////
+
+    Real thermal_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 3a: thermal conduct >>>" << std::endl;
+    }
+
+    if (use_thermal_diffusion) {
+        ThermalConduct(s1, s2, hcoeff1, Xkcoeff1, pcoeff1, hcoeff1, Xkcoeff1,
+                       pcoeff1);
+    }
+
+    thermal_time += ParallelDescriptor::second() - thermal_time_start;
+
+    misc_time_start = ParallelDescriptor::second();
+
+    // pass temperature through for seeding the temperature update eos call
+    // pi goes along for the ride
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(s2[lev], s1[lev], Temp, Temp, 1, ng_s);
+        MultiFab::Copy(s2[lev], s1[lev], Pi, Pi, 1, ng_s);
+    }
+
+    // now update temperature
+    if (use_tfromp) {
+        TfromRhoP(s2, p0_new, false);
+    } else {
+        TfromRhoH(s2, p0_new);
+    }
+
+    if (use_thermal_diffusion) {
+        // make a copy of s2star since these are needed to compute
+        // coefficients in the call to thermal_conduct_full_alg
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(s2star[lev], s2[lev], 0, 0, Nscal, ng_s);
+        }
+    }
+
+    misc_time += ParallelDescriptor::second() - misc_time_start;
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 4 -- react the full state through dt with the advective source
+    //////////////////////////////////////////////////////////////////////////////
+
+    Real react_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 4 : react state >>>" << std::endl;
+    }
+
+    // the advective source, (s2 - s1) / dt, of rho, rho h, rho X, and the
+    // auxiliary variables -- temperature and pi are not integrated
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::LinComb(sdc_source[lev], 1. / dt, s2[lev], 0, -1. / dt,
+                          s1[lev], 0, 0, Nscal, 0);
+        sdc_source[lev].setVal(0., Temp, 1, 0);
+        sdc_source[lev].setVal(0., Pi, 1, 0);
+    }
+
+    React(s1, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, dt, t_old,
+          sdc_source);
+
+    react_time += ParallelDescriptor::second() - react_time_start;
+
+    misc_time_start = ParallelDescriptor::second();
+
+    if (evolve_base_state) {
+        // compute beta0 and gamma1bar
+        MakeGamma1bar(snew, gamma1bar_new, p0_new);
+
+        Real base_time_start = ParallelDescriptor::second();
+
+        MakeBeta0(beta0_new, rho0_new, p0_new, gamma1bar_new, grav_cell_new);
+
+        base_time += ParallelDescriptor::second() - base_time_start;
+    } else {
+        // Just pass beta0 and gamma1bar through if not evolving base state
+        beta0_new.copy(beta0_old);
+        gamma1bar_new.copy(gamma1bar_old);
+    }
+
+    beta0_nph.copy(0.5 * (beta0_old + beta0_new));
+
+    misc_time += ParallelDescriptor::second() - misc_time_start;
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 5 -- correct the coupling of the advection and the reactions
+    //////////////////////////////////////////////////////////////////////////////
+
+    for (int misdc = 1; misdc <= sdc_iters; ++misdc) {
+        if (maestro_verbose >= 1) {
+            Print() << "<<< STEP 5 : SDC iteration " << misdc << " >>>"
+                    << std::endl;
+        }
+
+        // the new S, w0, and MAC velocity are made from the latest reactions
+        // once, or in every iteration if sdc_couple_mac_velocity
+        if (misdc == 1 || sdc_couple_mac_velocity) {
+            advect_time_start = ParallelDescriptor::second();
+
+            if (maestro_verbose >= 1) {
+                Print() << "            : make new S and new w0 >>>"
+                        << std::endl;
+            }
+
+            if (evolve_base_state) {
+                // reset cutoff coordinates to old time value
+                ComputeCutoffCoords(rho0_old);
+                base_geom.ComputeCutoffCoords(rho0_old.array());
+            }
+
+            if (use_thermal_diffusion) {
+                MakeThermalCoeffs(snew, Tcoeff, hcoeff2, Xkcoeff2, pcoeff2);
+
+                MakeExplicitThermal(thermal2, snew, Tcoeff, hcoeff2, Xkcoeff2,
+                                    pcoeff2, p0_new,
+                                    temp_diffusion_formulation);
+            } else {
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    thermal2[lev].setVal(0.);
+                }
+            }
+
+            // compute S at cell-centers
+            Make_S_cc(S_cc_new, delta_gamma1_term, delta_gamma1, snew, uold,
+                      rho_omegadot, rho_Hnuc, rho_Hext, thermal2, p0_old,
+                      gamma1bar_new, delta_gamma1_termbar);
+
+            // set S_cc_nph = (1/2) (S_cc_old + S_cc_new)
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::LinComb(S_cc_nph[lev], 0.5, S_cc_old[lev], 0, 0.5,
+                                  S_cc_new[lev], 0, 0, 1, 0);
+            }
+            AverageDown(S_cc_nph, 0, 1);
+
+            // compute p0_minus_peosbar = p0_new - peosbar_new (for making
+            // w0) and set delta_p_term = peos_new - p0_new (for RHS of
+            // projection)
+            if (dpdt_factor > 0.) {
+                // peos now holds "peos_new", the thermodynamic p computed
+                // from snew(rho,h,X)
+                PfromRhoH(snew, snew, delta_p_term);
+
+                // compute peosbar = Avg(peos_new)
+                Average(delta_p_term, peosbar, 0);
+
+                // compute p0_minus_peosbar = p0_new - peosbar
+                p0_minus_peosbar.copy(p0_new - peosbar);
+
+                // put p0_new on cart
+                Put1dArrayOnCart(p0_new, p0_cart, false, false, bcs_f, 0);
+
+                // set delta_p_term = peos_new - p0_new
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0,
+                                       1, 0);
+                }
+            } else {
+                // these should have no effect if dpdt_factor <= 0
+                p0_minus_peosbar.setVal(0.);
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    delta_p_term[lev].setVal(0.);
+                }
+            }
+
+            if (evolve_base_state) {
+                // compute Sbar = average(S_cc_nph)
+                Average(S_cc_nph, Sbar, 0);
+
+                // compute Sbar = Sbar + delta_gamma1_termbar
+                if (use_delta_gamma1_term) {
+                    Sbar += delta_gamma1_termbar;
+                }
+
+                Real base_time_start = ParallelDescriptor::second();
+
+                ComputeCutoffCoords(rho0_old);
+                base_geom.ComputeCutoffCoords(rho0_old.array());
+
+                // compute w0, w0_force
+                is_predictor = false;
+                Makew0(w0_old, w0_force, Sbar, rho0_old, rho0_new, p0_old,
+                       p0_new, gamma1bar_old, gamma1bar_new, p0_minus_peosbar,
+                       dt, dtold, is_predictor);
+
+                Put1dArrayOnCart(w0, w0_cart, true, true, bcs_u, 0, 1);
+
+                base_time += ParallelDescriptor::second() - base_time_start;
+
+#if (AMREX_SPACEDIM == 3)
+                if (spherical) {
+                    // put w0 on Cartesian edges
+                    MakeW0mac(w0mac);
+                }
+#endif
+                // put w0_force on Cartesian cells
+                Put1dArrayOnCart(w0_force, w0_force_cart, false, true, bcs_f,
+                                 0);
+            }
+
+            advect_time += ParallelDescriptor::second() - advect_time_start;
+
+            if (maestro_verbose >= 1) {
+                Print() << "            : create MAC velocities >>>"
+                        << std::endl;
+            }
+
+            MakeMacVelocity(false, umac, w0mac, w0_force_cart, macphi, macrhs,
+                            S_cc_nph, Sbar, beta0_nph, delta_gamma1_term,
+                            delta_p_term, delta_chi, advect_time,
+                            macproj_time);
+        }
+
+        advect_time_start = ParallelDescriptor::second();
+
+        // the reactions of the last iteration, as a force on the quantities
+        // predicted to the edges.  As in MISDC, the correction lags the
+        // reactions by one iteration: rho_omegadot and rho_Hnuc are those
+        // of the React call that ended the previous iteration (or the
+        // predictor), and React below replaces them for the next one.
+        MakeIntraCoeffs(s1, snew, cp, xi);
+        MakeIntraForce(intra_force, rho_omegadot, rho_Hnuc, rho_Hext, s1, cp,
+                       xi);
+
+        if (maestro_verbose >= 1) {
+            Print() << "            : advect base >>>" << std::endl;
+        }
+
+        // advect the base state density
+        if (evolve_base_state) {
+            Real base_time_start = ParallelDescriptor::second();
+
+            AdvectBaseDens(rho0_predicted_edge);
+
+            base_time += ParallelDescriptor::second() - base_time_start;
+
+            ComputeCutoffCoords(rho0_new);
+            base_geom.ComputeCutoffCoords(rho0_new.array());
+        }
+
+        // copy temperature from s1 into s2 for seeding eos calls
+        // temperature will be overwritten later after enthalpy advance
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(s2[lev], s1[lev], Temp, Temp, 1, ng_s);
+        }
+
+        if (maestro_verbose >= 1) {
+            Print() << "            :  density_advance >>>" << std::endl;
+            Print() << "            :   tracer_advance >>>" << std::endl;
+        }
+
+        // set etarhoflux to zero
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            etarhoflux[lev].setVal(0.);
+        }
+
+        // need full UMAC velocities for DensityAdvance
+        Addw0(umac, w0mac, 1.);
+
+        // advect rhoX, rho, and tracers
+        DensityAdvance(2, s1, s2, sedge, sflux, scal_force, etarhoflux, umac,
+                       w0mac, rho0_predicted_edge, intra_force);
+
+        // subtract w0mac from umac
+        Addw0(umac, w0mac, -1.);
+
+        UpdateBaseState(2, s1, s2, umac, w0mac, etarhoflux,
+                        rho0_predicted_edge, rho0_nph, p0_nph, grav_cell_nph,
+                        gamma1bar_temp1, gamma1bar_temp2, Sbar, base_time);
+
+        if (maestro_verbose >= 1) {
+            Print() << "            : enthalpy_advance >>>" << std::endl;
+        }
+
+        // need full UMAC velocities for EnthalpyAdvance
+        Addw0(umac, w0mac, 1.);
+
+        // thermal1 is the explicit conduction term of the old state, as in
+        // step 8 of AdvanceTimeStep: s1 is the same in every iteration, so
+        // it is not remade, and the time-centered conduction is added by
+        // ThermalConduct below
+        EnthalpyAdvance(2, s1, s2, sedge, sflux, scal_force, umac, w0mac,
+                        thermal1, intra_force);
+
+        // subtract w0mac from umac
+        Addw0(umac, w0mac, -1.);
+
+        advect_time += ParallelDescriptor::second() - advect_time_start;
+
+        thermal_time_start = ParallelDescriptor::second();
+
+        if (maestro_verbose >= 1) {
+            Print() << "            : thermal conduct >>>" << std::endl;
+        }
+
+        if (use_thermal_diffusion) {
+            MakeThermalCoeffs(s2star, Tcoeff, hcoeff2, Xkcoeff2, pcoeff2);
+
+            ThermalConduct(s1, s2, hcoeff1, Xkcoeff1, pcoeff1, hcoeff2,
+                           Xkcoeff2, pcoeff2);
+        }
+
+        thermal_time += ParallelDescriptor::second() - thermal_time_start;
+
+        misc_time_start = ParallelDescriptor::second();
+
+        // pass temperature through for seeding the temperature update eos
+        // call; pi goes along for the ride
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(s2[lev], s1[lev], Temp, Temp, 1, ng_s);
+            MultiFab::Copy(s2[lev], s1[lev], Pi, Pi, 1, ng_s);
+        }
+
+        // now update temperature
+        if (use_tfromp) {
+            TfromRhoP(s2, p0_new, false);
+        } else {
+            TfromRhoH(s2, p0_new);
+        }
+
+        if (use_thermal_diffusion) {
+            // the next iteration takes its coefficients from this one
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(s2star[lev], s2[lev], 0, 0, Nscal, ng_s);
+            }
+        }
+
+        misc_time += ParallelDescriptor::second() - misc_time_start;
+
+        react_time_start = ParallelDescriptor::second();
+
+        if (maestro_verbose >= 1) {
+            Print() << "            : react state >>>" << std::endl;
+        }
+
+        // the advective source of this iteration.  s2 includes the
+        // reactions only through the edge states, so this is again the
+        // advection alone.
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::LinComb(sdc_source[lev], 1. / dt, s2[lev], 0, -1. / dt,
+                              s1[lev], 0, 0, Nscal, 0);
+            sdc_source[lev].setVal(0., Temp, 1, 0);
+            sdc_source[lev].setVal(0., Pi, 1, 0);
+        }
+
+        React(s1, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, dt, t_old,
+              sdc_source);
+
+        react_time += ParallelDescriptor::second() - react_time_start;
+
+        misc_time_start = ParallelDescriptor::second();
+
+        if (evolve_base_state) {
+            // compute beta0 and gamma1bar
+            MakeGamma1bar(snew, gamma1bar_new, p0_new);
+
+            Real base_time_start = ParallelDescriptor::second();
+
+            MakeBeta0(beta0_new, rho0_new, p0_new, gamma1bar_new,
+                      grav_cell_new);
+
+            base_time += ParallelDescriptor::second() - base_time_start;
+        }
+
+        beta0_nph.copy(0.5 * (beta0_old + beta0_new));
+
+        misc_time += ParallelDescriptor::second() - misc_time_start;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 6 -- compute S^{n+1} for the final projection
+    //////////////////////////////////////////////////////////////////////////////
+
+    Real ndproj_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 6 : make new S >>>" << std::endl;
+    }
+
+    if (use_thermal_diffusion) {
+        MakeThermalCoeffs(snew, Tcoeff, hcoeff2, Xkcoeff2, pcoeff2);
+
+        MakeExplicitThermal(thermal2, snew, Tcoeff, hcoeff2, Xkcoeff2, pcoeff2,
+                            p0_new, temp_diffusion_formulation);
+    }
+
+    Make_S_cc(S_cc_new, delta_gamma1_term, delta_gamma1, snew, uold,
+              rho_omegadot, rho_Hnuc, rho_Hext, thermal2, p0_new, gamma1bar_new,
+              delta_gamma1_termbar);
+
+    if (evolve_base_state) {
+        Average(S_cc_new, Sbar, 0);
+
+        // compute Sbar = Sbar + delta_gamma1_termbar
+        if (use_delta_gamma1_term) {
+            Sbar += delta_gamma1_termbar;
+        }
+    }
+
+    // define dSdt = (S_cc_new - S_cc_old) / dt
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::LinComb(dSdt[lev], -1. / dt, S_cc_old[lev], 0, 1. / dt,
+                          S_cc_new[lev], 0, 0, 1, 0);
+    }
+
+    ndproj_time += ParallelDescriptor::second() - ndproj_time_start;
+
+    //////////////////////////////////////////////////////////////////////////////
+    // STEP 7 -- update the velocity
+    //////////////////////////////////////////////////////////////////////////////
+
+    advect_time_start = ParallelDescriptor::second();
+
+    if (maestro_verbose >= 1) {
+        Print() << "<<< STEP 7 : update and project new velocity >>>"
+                << std::endl;
+    }
+
+    // Define rho at half time using the new rho from Step 5
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // needed to avoid NaNs in filling corner ghost cells with 2 physical boundaries
+        rhohalf[lev].setVal(0.);
+    }
+    FillPatch(0.5 * (t_old + t_new), rhohalf, sold, snew, Rho, 0, 1, Rho,
+              bcs_s);
+
+    VelocityAdvance(rhohalf, umac, w0mac, w0_force_cart, rho0_nph,
+                    grav_cell_nph, sponge);
+
+    if (evolve_base_state && is_initIter) {
+        // throw away w0 by setting w0 = w0_old
+        w0.copy(w0_old);
+    }
+
+    advect_time += ParallelDescriptor::second() - advect_time_start;
+
+    ndproj_time_start = ParallelDescriptor::second();
+
+    // Project the new velocity field
+    ProjectNewVelocity(is_initIter, delta_gamma1_term, delta_p_term, p0_cart,
+                       Sbar, beta0_nph);
+
+    ndproj_time += ParallelDescriptor::second() - ndproj_time_start;
+
+    misc_time_start = ParallelDescriptor::second();
+
+    if (!is_initIter) {
+        if (!fix_base_state) {
+            // compute tempbar by "averaging"
+            Average(snew, tempbar, Temp);
+        }
+    }
+
+    // hand the level-wide temporaries back to the scratch pool so the
+    // next time step can reuse them
+    ReleaseScratch(rhohalf);
+    ReleaseScratch(macrhs);
+    ReleaseScratch(macphi);
+    ReleaseScratch(S_cc_nph);
+    ReleaseScratch(rho_omegadot);
+    ReleaseScratch(thermal1);
+    ReleaseScratch(thermal2);
+    ReleaseScratch(rho_Hnuc);
+    ReleaseScratch(rho_Hext);
+    ReleaseScratch(s1);
+    ReleaseScratch(s2);
+    ReleaseScratch(s2star);
+    ReleaseScratch(delta_gamma1_term);
+    ReleaseScratch(delta_gamma1);
+    ReleaseScratch(p0_cart);
+    ReleaseScratch(delta_p_term);
+    ReleaseScratch(Tcoeff);
+    ReleaseScratch(hcoeff1);
+    ReleaseScratch(Xkcoeff1);
+    ReleaseScratch(pcoeff1);
+    ReleaseScratch(hcoeff2);
+    ReleaseScratch(Xkcoeff2);
+    ReleaseScratch(pcoeff2);
+    ReleaseScratch(scal_force);
+    ReleaseScratch(delta_chi);
+    ReleaseScratch(sponge);
+    ReleaseScratch(sdc_source);
+    ReleaseScratch(intra_force);
+    ReleaseScratch(cp);
+    ReleaseScratch(xi);
+    ReleaseScratch(etarhoflux);
+    ReleaseScratch(w0_force_cart);
+    ReleaseScratch(umac);
+    ReleaseScratch(sedge);
+    ReleaseScratch(sflux);
+    ReleaseScratch(w0mac);
+
+    Print() << "\nTimestep " << istep << " ends with TIME = " << t_new
+            << " DT = " << dt << std::endl;
+
+    misc_time += ParallelDescriptor::second() - misc_time_start;
+
+    // the slowest rank sets the times
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    ParallelDescriptor::ReduceRealMax(advect_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(macproj_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(ndproj_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(thermal_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(react_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(misc_time, ioproc);
+    ParallelDescriptor::ReduceRealMax(base_time, ioproc);
+
+    Real setup_time = solver_setup_time;
+    ParallelDescriptor::ReduceRealMax(setup_time, ioproc);
+
+    // print wallclock time
+    if (maestro_verbose > 0) {
+        Print() << "Timing summary:\n";
+        Print() << "Advection  :" << advect_time << " seconds\n";
+        Print() << "MAC Proj   :" << macproj_time << " seconds\n";
+        Print() << "Nodal Proj :" << ndproj_time << " seconds\n";
+        if (use_thermal_diffusion) {
+            Print() << "Thermal    :" << thermal_time << " seconds\n";
+        }
+        Print() << "Reactions  :" << react_time << " seconds\n";
+        Print() << "Misc       :" << misc_time << " seconds\n";
+        Print() << "Base State :" << base_time << " seconds\n";
+        // this is included in the projection and thermal times above
+        Print() << "Solver setup :" << setup_time << " seconds\n";
+        PrintScratchPool();
+        PrintFabHighWater();
+    }
+}
+
+// the reactions of the last SDC iteration as a force on the quantities
+// that are predicted to the edges
+void Maestro::MakeIntraForce(Vector<MultiFab>& intra_force,
+                             const Vector<MultiFab>& rho_omegadot,
+                             const Vector<MultiFab>& rho_Hnuc,
+                             const Vector<MultiFab>& rho_Hext,
+                             const Vector<MultiFab>& scal,
+                             const Vector<MultiFab>& cp,
+                             const Vector<MultiFab>& xi) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeIntraForce()", MakeIntraForce);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(scal[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<Real> force = intra_force[lev].array(mfi);
+            const Array4<const Real> omegadot = rho_omegadot[lev].array(mfi);
+            const Array4<const Real> Hnuc = rho_Hnuc[lev].array(mfi);
+            const Array4<const Real> Hext = rho_Hext[lev].array(mfi);
+            const Array4<const Real> scal_arr = scal[lev].array(mfi);
+            const Array4<const Real> cp_arr = cp[lev].array(mfi);
+            const Array4<const Real> xi_arr = xi[lev].array(mfi);
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                for (auto comp = 0; comp < Nscal; ++comp) {
+                    force(i, j, k, comp) = 0.0;
+                }
+
+                const Real rho = scal_arr(i, j, k, Rho);
+
+                // the reactions conserve mass, so X is forced by
+                // rho_omegadot / rho
+                for (auto n = 0; n < NumSpec; ++n) {
+                    force(i, j, k, FirstSpec + n) =
+                        (species_pred_type == predict_rhoX)
+                            ? omegadot(i, j, k, n)
+                            : omegadot(i, j, k, n) / rho;
+                }
+
+                const Real rhoh_rate = Hnuc(i, j, k) + Hext(i, j, k);
+                force(i, j, k, RhoH) = (enthalpy_pred_type == predict_h ||
+                                        enthalpy_pred_type == predict_hprime)
+                                           ? rhoh_rate / rho
+                                           : rhoh_rate;
+
+                // rho cp DT/Dt = D(rho h)/Dt - sum_k xi_k rho DX_k/Dt + ...
+                Real T_rate = rhoh_rate;
+                for (auto n = 0; n < NumSpec; ++n) {
+                    T_rate -= xi_arr(i, j, k, n) * omegadot(i, j, k, n);
+                }
+                force(i, j, k, Temp) = T_rate / (rho * cp_arr(i, j, k));
+            });
+        }
+    }
+
+    // average down and fill ghost cells
+    AverageDown(intra_force, 0, Nscal);
+    FillPatch(t_old, intra_force, intra_force, intra_force, 0, 0, Nscal, 0,
+              bcs_f);
+}
+
+// the steps below are those of AdvanceTimeStep, shared by the predictor and
+// the SDC iterations
+
+// construct the advective velocity: compute the unprojected MAC velocities
+// and project them, with the base state at time n in the predictor and at
+// time n+1 (beta0 at n+1/2) in the corrector
+void Maestro::MakeMacVelocity(
+    const bool is_predictor,
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
+    const Vector<std::array<MultiFab, AMREX_SPACEDIM> >& w0mac,
+    const Vector<MultiFab>& w0_force_cart, Vector<MultiFab>& macphi,
+    Vector<MultiFab>& macrhs, const Vector<MultiFab>& S_cc_nph,
+    const BaseState<Real>& Sbar, const BaseState<Real>& beta0,
+    Vector<MultiFab>& delta_gamma1_term, const Vector<MultiFab>& delta_p_term,
+    Vector<MultiFab>& delta_chi, Real& advect_time, Real& macproj_time) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeMacVelocity()", MakeMacVelocity);
+
+    Real advect_time_start = ParallelDescriptor::second();
+
+    // compute unprojected MAC velocities
+    AdvancePremac(umac, w0mac, w0_force_cart);
+
+    if (is_predictor) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            delta_chi[lev].setVal(0.);
+            macphi[lev].setVal(0.);
+            delta_gamma1_term[lev].setVal(0.);
+        }
+
+        // start from the last step's MAC solution if warm_start_projections
+        LoadProjectionGuess(macphi, macphi_guess);
+    }
+
+    const BaseState<Real>& rho0 = is_predictor ? rho0_old : rho0_new;
+    const BaseState<Real>& gamma1bar =
+        is_predictor ? gamma1bar_old : gamma1bar_new;
+    const BaseState<Real>& p0 = is_predictor ? p0_old : p0_new;
+
+    // compute RHS for MAC projection, beta0*(S_cc-Sbar) + beta0*delta_chi
+    MakeRHCCforMacProj(macrhs, rho0, S_cc_nph, Sbar, beta0, delta_gamma1_term,
+                       gamma1bar, p0, delta_p_term, delta_chi, is_predictor);
+
+    advect_time += ParallelDescriptor::second() - advect_time_start;
+
+    Real macproj_time_start = ParallelDescriptor::second();
+
+    // MAC projection
+    // includes spherical option in C++ function
+    MacProj(umac, macphi, macrhs, beta0, is_predictor);
+    if (!is_predictor) {
+        SaveProjectionGuess(macphi, macphi_guess);
+    }
+
+    macproj_time += ParallelDescriptor::second() - macproj_time_start;
+}
+
+// update the base state after the density advance: rho0 (if use_etarho),
+// gravity, p0 through HSE, psi and rhoh0.  which_step = 1 is the
+// predictor, which_step = 2 the corrector, which also makes the
+// time-centered rho0, p0 and gravity
+void Maestro::UpdateBaseState(
+    const int which_step, const Vector<MultiFab>& s1,
+    const Vector<MultiFab>& s2,
+    const Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
+    const Vector<std::array<MultiFab, AMREX_SPACEDIM> >& w0mac,
+    const Vector<MultiFab>& etarhoflux, BaseState<Real>& rho0_predicted_edge,
+    BaseState<Real>& rho0_nph, BaseState<Real>& p0_nph,
+    BaseState<Real>& grav_cell_nph, BaseState<Real>& gamma1bar_temp1,
+    BaseState<Real>& gamma1bar_temp2, const BaseState<Real>& Sbar,
+    Real& base_time) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::UpdateBaseState()", UpdateBaseState);
+
+    if (!evolve_base_state) {
+        if (which_step == 1) {
+            rhoh0_new.copy(rhoh0_old);
+            grav_cell_new.copy(grav_cell_old);
+            p0_new.copy(p0_old);
+        } else {
+            rho0_nph.copy(rho0_old);
+            grav_cell_nph.copy(grav_cell_old);
+        }
+        return;
+    }
+
+    if (use_etarho) {
+        // compute the new etarho
+        if (!spherical) {
+            MakeEtarho(etarhoflux);
+#if AMREX_SPACEDIM == 3
+        } else {
+            MakeEtarhoSphr(s1, s2, umac, w0mac);
+#endif
+        }
+
+        if (which_step == 1) {
+            // correct the base state density and compute rhoh0_old by
+            // "averaging"
+            Average({{s2, Rho, rho0_new}, {s1, RhoH, rhoh0_old}});
+        } else {
+            // correct the base state density by "averaging"
+            Average(s2, rho0_new, Rho);
+        }
+        ComputeCutoffCoords(rho0_new);
+        base_geom.ComputeCutoffCoords(rho0_new.array());
+    }
+
+    // update grav_cell_new, and rho0_nph and grav_cell_nph in the corrector
+    Real base_time_start = ParallelDescriptor::second();
+
+    MakeGravCell(grav_cell_new, rho0_new);
+
+    if (which_step == 2) {
+        rho0_nph.copy(0.5 * (rho0_old + rho0_new));
+        MakeGravCell(grav_cell_nph, rho0_nph);
+    }
+
+    base_time += ParallelDescriptor::second() - base_time_start;
+
+    // base state pressure update
+    // set new p0 through HSE
+    p0_new.copy(p0_old);
+
+    base_time_start = ParallelDescriptor::second();
+
+    EnforceHSE(rho0_new, p0_new, grav_cell_new);
+
+    base_time += ParallelDescriptor::second() - base_time_start;
+
+    if (which_step == 2) {
+        p0_nph.copy(0.5 * (p0_old + p0_new));
+    }
+
+    // make psi
+    if (!spherical) {
+        MakePsiPlanar();
+    } else if (which_step == 1) {
+        // compute p0_nph
+        p0_nph.copy(0.5 * (p0_old + p0_new));
+
+        // compute gamma1bar^{(1)} and store it in gamma1bar_temp1
+        // compute gamma1bar^{(2),*} and store it in gamma1bar_temp2
+        MakeGamma1bar(s1, gamma1bar_temp1, p0_old, s2, gamma1bar_temp2,
+                      p0_new);
+
+        // compute gamma1bar^{nph,*} and store it in gamma1bar_temp2
+        gamma1bar_temp2.copy(0.5 * (gamma1bar_temp1 + gamma1bar_temp2));
+
+        // make time-centered psi
+        MakePsiSphr(gamma1bar_temp2, p0_nph, Sbar);
+    } else {
+        // compute gamma1bar^{(2)} and store it in gamma1bar_temp2
+        MakeGamma1bar(s2, gamma1bar_temp2, p0_new);
+
+        base_time_start = ParallelDescriptor::second();
+
+        // compute gamma1bar^{nph} and store it in gamma1bar_temp2
+        gamma1bar_temp2.copy(0.5 * (gamma1bar_temp1 + gamma1bar_temp2));
+
+        MakePsiSphr(gamma1bar_temp2, p0_nph, Sbar);
+
+        base_time += ParallelDescriptor::second() - base_time_start;
+    }
+
+    // base state enthalpy update
+    // compute rhoh0_old by "averaging" (done above along with rho0_new
+    // if use_etarho)
+    if (which_step == 1 && !use_etarho) {
+        Average(s1, rhoh0_old, RhoH);
+    }
+
+    base_time_start = ParallelDescriptor::second();
+
+    AdvectBaseEnthalpy(rho0_predicted_edge);
+
+    base_time += ParallelDescriptor::second() - base_time_start;
+}
+
+// project the new velocity field: a divu iteration during the initial
+// pressure iterations, a regular time step projection otherwise
+void Maestro::ProjectNewVelocity(const bool is_initIter,
+                                 const Vector<MultiFab>& delta_gamma1_term,
+                                 Vector<MultiFab>& delta_p_term,
+                                 Vector<MultiFab>& p0_cart,
+                                 const BaseState<Real>& Sbar,
+                                 const BaseState<Real>& beta0_nph) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ProjectNewVelocity()", ProjectNewVelocity);
+
+    int proj_type{0};
+
+    if (is_initIter) {
+        proj_type = pressure_iters_comp;
+
+        // rhcc_for_nodalproj needs to contain
+        // (beta0^nph S^1 - beta0^n S^0 ) / dt
+
+        Vector<MultiFab> rhcc_for_nodalproj_old(finest_level + 1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            DefineScratch(rhcc_for_nodalproj_old[lev], grids[lev],
+                          dmap[lev], 1, 1);
+            MultiFab::Copy(rhcc_for_nodalproj_old[lev], rhcc_for_nodalproj[lev],
+                           0, 0, 1, 1);
+        }
+
+        MakeRHCCforNodalProj(rhcc_for_nodalproj, S_cc_new, Sbar, beta0_nph,
+                             delta_gamma1_term);
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Subtract(rhcc_for_nodalproj[lev],
+                               rhcc_for_nodalproj_old[lev], 0, 0, 1, 1);
+            rhcc_for_nodalproj[lev].mult(1. / dt, 0, 1, 1);
+        }
+        ReleaseScratch(rhcc_for_nodalproj_old);
+
+    } else {
+        proj_type = regular_timestep_comp;
+
+        MakeRHCCforNodalProj(rhcc_for_nodalproj, S_cc_new, Sbar, beta0_nph,
+                             delta_gamma1_term);
+
+        // compute delta_p_term = peos_new - p0_new (for RHS of projection)
+        if (dpdt_factor > 0.) {
+            // peos now holds "peos_new", the thermodynamic p computed from snew(rho,h,X)
+            PfromRhoH(snew, snew, delta_p_term);
+
+            // put p0_new on cart
+            Put1dArrayOnCart(p0_new, p0_cart, false, false, bcs_f, 0);
+
+            // compute delta_p_term = peos_new - p0_new
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Subtract(delta_p_term[lev], p0_cart[lev], 0, 0, 1, 0);
+            }
+
+            CorrectRHCCforNodalProj(rhcc_for_nodalproj, rho0_new, beta0_nph,
+                                    gamma1bar_new, p0_new, delta_p_term);
+        }
+    }
+
+    // call nodal projection
+    NodalProj(proj_type, rhcc_for_nodalproj);
+
+    beta0_nm1.copy(0.5 * (beta0_old + beta0_new));
+}
+
+#endif